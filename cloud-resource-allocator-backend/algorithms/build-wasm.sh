@@ -0,0 +1,23 @@
+#!/bin/sh
+# Builds each engine as an ES6 WebAssembly module for in-browser simulation.
+# Requires emcc (Emscripten) on PATH.
+#
+# Usage: ./build-wasm.sh [output dir]
+set -e
+
+SRC_DIR=$(dirname "$0")
+OUT_DIR=${1:-"$SRC_DIR/../../cloud-resource-allocator/public/wasm"}
+mkdir -p "$OUT_DIR"
+
+for algo in fcfs sjf priority srtf rr fifo lru; do
+    case $algo in
+        fifo|lru) entry=_replacePages ;;
+        *) entry=_schedule ;;
+    esac
+
+    emcc -O3 "$SRC_DIR/$algo.cpp" -o "$OUT_DIR/$algo.js" \
+        -s MODULARIZE=1 -s EXPORT_ES6=1 -s ENVIRONMENT=web,worker \
+        -s ALLOW_MEMORY_GROWTH=1 \
+        -s "EXPORTED_FUNCTIONS=['$entry','_malloc','_free']" \
+        -s "EXPORTED_RUNTIME_METHODS=['HEAP32']"
+done
@@ -0,0 +1,335 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <climits>
+#include <numeric>
+#include <string>
+#include <cstring>
+
+using namespace std;
+
+// Tenant vruntime is fixed point: one unit of CPU time at weight w advances it
+// by scale / w. The scale is the LCM of the tenant weights when that is at most
+// MAX_VRUNTIME_SCALE, which makes every step exact. In that case multiplying all
+// weights by k gives the same schedule. Otherwise the scale is
+// MAX_VRUNTIME_SCALE, and the division remainder is carried into the next
+// slice so no service is lost to truncation. Weights are clamped to
+// [1, MAX_WEIGHT].
+const long long MAX_VRUNTIME_SCALE = 1LL << 30;
+const int MAX_WEIGHT = 1 << 20;
+
+// Slice lengths follow CFS: each scheduling period is shared among the
+// runnable tenants by weight, and no slice is shorter than the minimum
+// granularity. The period is LATENCY_GRANULARITY_RATIO granularities, as in
+// Linux's sched_latency / sched_min_granularity. Time units are abstract, so
+// the granularity is the mean burst divided by SLICES_PER_BURST, never below
+// MIN_GRANULARITY. Each job then takes a bounded number of slices, and the run
+// time grows with the number of jobs rather than with total CPU time.
+const int MIN_GRANULARITY = 1;
+const int LATENCY_GRANULARITY_RATIO = 8;
+const int SLICES_PER_BURST = 8;
+
+long long vruntimeScale(const vector<int>& weights) {
+    long long scale = 1;
+    for (int w : weights) {
+        long long step = w / gcd(scale, (long long)w);
+        if (scale > MAX_VRUNTIME_SCALE / step) {
+            return MAX_VRUNTIME_SCALE;
+        }
+        scale *= step;
+    }
+    return scale;
+}
+
+// Min-heap of (vruntime, index) pairs. Only the front and the runner-up are
+// ever inspected, so a contiguous binary heap is enough and stays cache
+// friendly when millions of jobs are queued.
+struct VruntimeQueue : priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<>> {
+    long long runnerUp() const {
+        if (c.size() < 2) return LLONG_MAX;
+        return c.size() == 2 ? c[1].first : min(c[1].first, c[2].first);
+    }
+};
+
+struct Process {
+    int id;
+    int tenant;
+    int weight;
+    int arrivalTime;
+    int burstTime;
+    int remainingTime;
+    long long vruntime;
+    long long completionTime;
+    long long turnaroundTime;
+    long long waitingTime;
+    double slowdown;
+};
+
+struct Tenant {
+    int id;
+    int weight;
+    int jobs;
+    long long vruntime;
+    long long vruntimeRemainder;
+    long long minJobVruntime;
+    long long cpuTime;
+    double entitledTime;
+    double joinedAt;
+    double slowdownSum;
+    VruntimeQueue runnable;
+};
+
+struct TenantResult {
+    int tenant;
+    int weight;
+    int jobs;
+    long long cpuTime;
+    double share;
+    double normalizedShare;
+    double avgSlowdown;
+};
+
+// Two-level fair share: tenants are ordered by weighted virtual runtime, and
+// each tenant's jobs by their own virtual runtime. Each job carries its
+// tenant's weight; the first job seen for a tenant fixes it. Only the ratios
+// between tenant weights matter. Every pick, requeue and wake-up is a heap
+// operation, O(log n + log T).
+//
+// Fairness is measured against entitlement: while a tenant is runnable it is
+// owed weight / (sum of runnable weights) of each unit of CPU time. The
+// per-tenant normalizedShare is received / owed, and fairnessIndex is Jain's
+// index over those ratios (1.0 means perfectly weighted sharing).
+vector<Process> calculateFairShare(const vector<int>& arrivals, const vector<int>& bursts,
+                                   const vector<int>& tenantIds, const vector<int>& weights,
+                                   vector<TenantResult>& tenantResults, double& fairnessIndex) {
+    vector<Process> processes;
+    vector<Tenant> tenants;
+    vector<int> tenantOf;
+    unordered_map<int, int> tenantIndex;
+    int n = arrivals.size();
+
+    for (int i = 0; i < n; i++) {
+        auto it = tenantIndex.find(tenantIds[i]);
+        if (it == tenantIndex.end()) {
+            it = tenantIndex.emplace(tenantIds[i], tenants.size()).first;
+            tenants.push_back({tenantIds[i], clamp(weights[i], 1, MAX_WEIGHT), 0, 0, 0, 0, 0, 0.0, 0.0, 0.0, {}});
+        }
+        Tenant& t = tenants[it->second];
+        t.jobs++;
+        tenantOf.push_back(it->second);
+        processes.push_back({i + 1, tenantIds[i], t.weight, arrivals[i], bursts[i], bursts[i], 0, 0, 0, 0, 0.0});
+    }
+
+    vector<int> tenantWeights;
+    for (const auto& t : tenants) tenantWeights.push_back(t.weight);
+    const long long scale = vruntimeScale(tenantWeights);
+
+    long long totalBurst = 0;
+    for (int b : bursts) totalBurst += b;
+    const long long minGranularity = max<long long>(MIN_GRANULARITY, totalBurst / max(n, 1) / SLICES_PER_BURST);
+    const long long targetLatency = LATENCY_GRANULARITY_RATIO * minGranularity;
+
+    vector<int> byArrival(n);
+    for (int i = 0; i < n; i++) byArrival[i] = i;
+    stable_sort(byArrival.begin(), byArrival.end(), [&](int a, int b) {
+        return processes[a].arrivalTime < processes[b].arrivalTime;
+    });
+
+    VruntimeQueue tenantTree;
+    long long minVruntime = 0;
+    long long runnableWeight = 0;
+    double servicePerWeight = 0.0;
+    long long currentTime = 0;
+    int index = 0;
+
+    while (index < n || !tenantTree.empty()) {
+        while (index < n && processes[byArrival[index]].arrivalTime <= currentTime) {
+            int j = byArrival[index++];
+            Tenant& t = tenants[tenantOf[j]];
+            if (t.runnable.empty()) {
+                t.vruntime = max(t.vruntime, minVruntime);
+                t.joinedAt = servicePerWeight;
+                runnableWeight += t.weight;
+                tenantTree.push({t.vruntime, tenantOf[j]});
+            }
+            processes[j].vruntime = t.minJobVruntime;
+            t.runnable.push({processes[j].vruntime, j});
+        }
+
+        if (tenantTree.empty()) {
+            currentTime = processes[byArrival[index]].arrivalTime;
+            continue;
+        }
+
+        auto [tenantVruntime, ti] = tenantTree.top();
+        Tenant& t = tenants[ti];
+        auto [jobVruntime, j] = t.runnable.top();
+        Process& p = processes[j];
+
+        long long slice = p.remainingTime;
+        if (index < n) {
+            slice = min(slice, processes[byArrival[index]].arrivalTime - currentTime);
+        }
+        // This tenant's weighted share of the period; the runnable tenants
+        // are all still in tenantTree here.
+        long long period = max(targetLatency, (long long)tenantTree.size() * minGranularity);
+        long long idealSlice = max<long long>(minGranularity, (__int128)period * t.weight / runnableWeight);
+
+        long long untilFair = LLONG_MAX;
+        if (tenantTree.size() > 1) {
+            // Smallest slice that carries this tenant's vruntime past the runner-up.
+            __int128 gap = (__int128)(tenantTree.runnerUp() - tenantVruntime + 1) * t.weight - t.vruntimeRemainder;
+            untilFair = (long long)min<__int128>((gap + scale - 1) / scale, LLONG_MAX - 1);
+        }
+        if (t.runnable.size() > 1) {
+            untilFair = min(untilFair, t.runnable.runnerUp() - jobVruntime + 1);
+        }
+        if (untilFair != LLONG_MAX) {
+            slice = min(slice, max(untilFair, idealSlice));
+        }
+
+        tenantTree.pop();
+        t.runnable.pop();
+
+        currentTime += slice;
+        servicePerWeight += (double)slice / runnableWeight;
+        p.remainingTime -= slice;
+        p.vruntime += slice;
+        long long scaled = slice * scale + t.vruntimeRemainder;
+        t.vruntime += scaled / t.weight;
+        t.vruntimeRemainder = scaled % t.weight;
+        t.cpuTime += slice;
+
+        if (p.remainingTime == 0) {
+            p.completionTime = currentTime;
+            p.turnaroundTime = p.completionTime - p.arrivalTime;
+            p.waitingTime = p.turnaroundTime - p.burstTime;
+            p.slowdown = p.burstTime > 0 ? (double)p.turnaroundTime / p.burstTime : 1.0;
+            t.slowdownSum += p.slowdown;
+        } else {
+            t.runnable.push({p.vruntime, j});
+        }
+
+        if (t.runnable.empty()) {
+            t.minJobVruntime = max(t.minJobVruntime, p.vruntime);
+            t.entitledTime += t.weight * (servicePerWeight - t.joinedAt);
+            runnableWeight -= t.weight;
+        } else {
+            t.minJobVruntime = max(t.minJobVruntime, t.runnable.top().first);
+            tenantTree.push({t.vruntime, ti});
+        }
+
+        minVruntime = max(minVruntime, tenantTree.empty() ? t.vruntime : tenantTree.top().first);
+    }
+
+    long long totalCpu = 0;
+    for (const auto& t : tenants) totalCpu += t.cpuTime;
+
+    tenantResults.clear();
+    double sum = 0.0, sumSquares = 0.0;
+    for (const auto& t : tenants) {
+        double normalized = t.entitledTime > 0 ? t.cpuTime / t.entitledTime : 1.0;
+        tenantResults.push_back({t.id, t.weight, t.jobs, t.cpuTime,
+                                 totalCpu > 0 ? (double)t.cpuTime / totalCpu : 0.0,
+                                 normalized, t.slowdownSum / t.jobs});
+        sum += normalized;
+        sumSquares += normalized * normalized;
+    }
+    fairnessIndex = sumSquares > 0 ? sum * sum / (tenants.size() * sumSquares) : 1.0;
+
+    return processes;
+}
+
+void runAsService() {
+    string input;
+    while (getline(cin, input)) {
+        vector<int> arrivals, bursts, tenantIds, weights;
+        vector<int>* columns[] = {&arrivals, &bursts, &tenantIds, &weights};
+
+        size_t start = 0;
+        for (int c = 0; c < 4; c++) {
+            size_t sep = input.find(';', start);
+            string field = input.substr(start, sep == string::npos ? string::npos : sep - start);
+            char* token = strtok(const_cast<char*>(field.c_str()), ",");
+            while (token) {
+                columns[c]->push_back(stoi(token));
+                token = strtok(nullptr, ",");
+            }
+            if (sep == string::npos) break;
+            start = sep + 1;
+        }
+
+        vector<TenantResult> tenantResults;
+        double fairnessIndex;
+        auto results = calculateFairShare(arrivals, bursts, tenantIds, weights, tenantResults, fairnessIndex);
+
+        for (const auto& p : results) {
+            cout << p.id << ","
+                 << p.tenant << ","
+                 << p.weight << ","
+                 << p.arrivalTime << ","
+                 << p.burstTime << ","
+                 << p.completionTime << ","
+                 << p.turnaroundTime << ","
+                 << p.waitingTime << ","
+                 << p.slowdown << "|";
+        }
+        cout << ";";
+        for (const auto& t : tenantResults) {
+            cout << t.tenant << ","
+                 << t.weight << ","
+                 << t.jobs << ","
+                 << t.cpuTime << ","
+                 << t.share << ","
+                 << t.normalizedShare << ","
+                 << t.avgSlowdown << "|";
+        }
+        cout << ";" << fairnessIndex << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--service") == 0) {
+        runAsService();
+    } else {
+        vector<int> arrivals = {0, 0, 0, 1, 2, 4};
+        vector<int> bursts = {6, 6, 6, 3, 8, 6};
+        vector<int> tenantIds = {1, 1, 1, 2, 2, 3};
+        vector<int> weights = {1, 1, 1, 2, 2, 1};
+
+        vector<TenantResult> tenantResults;
+        double fairnessIndex;
+        auto results = calculateFairShare(arrivals, bursts, tenantIds, weights, tenantResults, fairnessIndex);
+
+        cout << "Fair Share Scheduling Results:\n";
+        cout << "PID\tTenant\tWeight\tArrival\tBurst\tCompletion\tTurnaround\tWaiting\tSlowdown\n";
+        for (const auto& p : results) {
+            cout << p.id << "\t" << p.tenant << "\t" << p.weight << "\t"
+                 << p.arrivalTime << "\t" << p.burstTime << "\t"
+                 << p.completionTime << "\t\t" << p.turnaroundTime << "\t\t"
+                 << p.waitingTime << "\t" << p.slowdown << "\n";
+        }
+
+        cout << "\nTenant\tWeight\tJobs\tCPU\tShare\tNormalized\tAvg Slowdown\n";
+        for (const auto& t : tenantResults) {
+            cout << t.tenant << "\t" << t.weight << "\t" << t.jobs << "\t"
+                 << t.cpuTime << "\t" << t.share << "\t" << t.normalizedShare << "\t\t"
+                 << t.avgSlowdown << "\n";
+        }
+        cout << "Fairness Index: " << fairnessIndex << "\n";
+
+        // Only weight ratios matter: k*w1 : k*w2 must schedule exactly like w1 : w2.
+        cout << "\nWeight Scale Check (two equal jobs, 1:2 scaled by k):\n";
+        cout << "k\tCompletion\tNormalized\tFairness\n";
+        for (int k : {1, 300, 3000, 100000}) {
+            vector<TenantResult> split;
+            double index;
+            auto scaled = calculateFairShare({0, 0}, {100, 100}, {1, 2}, {k, 2 * k}, split, index);
+            cout << k << "\t" << scaled[0].completionTime << "," << scaled[1].completionTime << "\t\t"
+                 << split[0].normalizedShare << ":" << split[1].normalizedShare << "\t\t" << index << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,354 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <queue>
+#include <climits>
+#include <string>
+#include <cstring>
+
+using namespace std;
+
+enum AdmissionPolicy { ADMIT_ALL, ADMIT_REJECT, ADMIT_DEFER };
+enum AdmissionStatus { ADMITTED = 0, DEFERRED = 1, REJECTED = 2 };
+
+struct Process {
+    int id;
+    int arrivalTime;
+    int burstTime;
+    int deadline;
+    int remainingTime;
+    int completionTime;
+    int turnaroundTime;
+    int waitingTime;
+    int lateness;
+    int status;
+    int slot;
+};
+
+struct EDFSummary {
+    int missCount;
+    double missRatio;
+    int maxLateness;
+    int rejected;
+    int deferred;
+};
+
+struct CompareDeadline {
+    bool operator()(const Process* a, const Process* b) const {
+        if (a->deadline == b->deadline) {
+            return a->id > b->id;
+        }
+        return a->deadline > b->deadline;
+    }
+};
+
+// Online feasibility test for preemptive EDF on one processor. Every admitted
+// job owns a slot ordered by (deadline, id); the slot holds
+// deadline - (pending admitted work up to and including that slot), so the set
+// is feasible at time t iff the minimum over occupied slots is >= t. Admitting,
+// running and retiring a job are each a range add or point update: O(log n).
+//
+// Slots are ranked up front from the whole batch's deadlines, so the tree is
+// sized and ordered before the first arrival. That is offline knowledge: each
+// admission decision only looks at jobs that have already arrived, but a
+// streaming front end would need deadline ranks it can assign as jobs come in
+// (for example, deadlines bucketed into a fixed horizon).
+class SlackTree {
+public:
+    explicit SlackTree(int n) : n(n), minSlack(4 * max(n, 1), INF), lazy(4 * max(n, 1), 0), work(n + 1, 0) {}
+
+    bool tryAdmit(int slot, int deadline, int burst, long long now) {
+        long long slack = deadline - pendingBefore(slot) - burst;
+        long long after = slot + 1 < n ? queryMin(1, 0, n - 1, slot + 1, n - 1) : INF;
+        if (slack < now || (after < INF && after - burst < now)) {
+            return false;
+        }
+        setLeaf(1, 0, n - 1, slot, slack);
+        if (slot + 1 < n) {
+            rangeAdd(1, 0, n - 1, slot + 1, n - 1, -burst);
+        }
+        addWork(slot, burst);
+        return true;
+    }
+
+    void consume(int slot, int amount) {
+        rangeAdd(1, 0, n - 1, slot, n - 1, amount);
+        addWork(slot, -amount);
+    }
+
+    void release(int slot) {
+        setLeaf(1, 0, n - 1, slot, INF);
+    }
+
+private:
+    static constexpr long long INF = LLONG_MAX / 4;
+    int n;
+    vector<long long> minSlack;
+    vector<long long> lazy;
+    vector<long long> work;
+
+    long long pendingBefore(int slot) const {
+        long long sum = 0;
+        for (int i = slot; i > 0; i -= i & -i) {
+            sum += work[i];
+        }
+        return sum;
+    }
+
+    void addWork(int slot, long long amount) {
+        for (int i = slot + 1; i <= n; i += i & -i) {
+            work[i] += amount;
+        }
+    }
+
+    void apply(int node, long long amount) {
+        if (minSlack[node] < INF) {
+            minSlack[node] += amount;
+        }
+        lazy[node] += amount;
+    }
+
+    void push(int node) {
+        if (lazy[node] != 0) {
+            apply(2 * node, lazy[node]);
+            apply(2 * node + 1, lazy[node]);
+            lazy[node] = 0;
+        }
+    }
+
+    void rangeAdd(int node, int lo, int hi, int l, int r, long long amount) {
+        if (r < lo || hi < l) return;
+        if (l <= lo && hi <= r) {
+            apply(node, amount);
+            return;
+        }
+        push(node);
+        int mid = (lo + hi) / 2;
+        rangeAdd(2 * node, lo, mid, l, r, amount);
+        rangeAdd(2 * node + 1, mid + 1, hi, l, r, amount);
+        minSlack[node] = min(minSlack[2 * node], minSlack[2 * node + 1]);
+    }
+
+    void setLeaf(int node, int lo, int hi, int slot, long long value) {
+        if (lo == hi) {
+            minSlack[node] = value;
+            lazy[node] = 0;
+            return;
+        }
+        push(node);
+        int mid = (lo + hi) / 2;
+        if (slot <= mid) {
+            setLeaf(2 * node, lo, mid, slot, value);
+        } else {
+            setLeaf(2 * node + 1, mid + 1, hi, slot, value);
+        }
+        minSlack[node] = min(minSlack[2 * node], minSlack[2 * node + 1]);
+    }
+
+    long long queryMin(int node, int lo, int hi, int l, int r) {
+        if (r < lo || hi < l) return INF;
+        if (l <= lo && hi <= r) return minSlack[node];
+        push(node);
+        int mid = (lo + hi) / 2;
+        return min(queryMin(2 * node, lo, mid, l, r), queryMin(2 * node + 1, mid + 1, hi, l, r));
+    }
+};
+
+// Rejected jobs never run. Deferred jobs run as background work, only when no
+// admitted job is ready. In preemptive mode the admission test is exact. In
+// non-preemptive mode the job on the CPU, admitted or deferred, cannot be
+// displaced, so its remaining work is taken out of the tree at dispatch and
+// every later admission is tested as if it starts once that job finishes. An
+// admitted job then always meets its deadline in either mode.
+vector<Process> calculateEDF(const vector<int>& arrivals, const vector<int>& bursts, const vector<int>& deadlines,
+                             bool preemptive, AdmissionPolicy policy, EDFSummary& summary) {
+    vector<Process> processes;
+    int n = arrivals.size();
+
+    for (int i = 0; i < n; i++) {
+        processes.push_back({i + 1, arrivals[i], bursts[i], deadlines[i], bursts[i], 0, 0, 0, 0, ADMITTED, 0});
+    }
+
+    vector<int> bySlot(n);
+    for (int i = 0; i < n; i++) bySlot[i] = i;
+    sort(bySlot.begin(), bySlot.end(), [&](int a, int b) {
+        return CompareDeadline()(&processes[b], &processes[a]);
+    });
+    for (int i = 0; i < n; i++) {
+        processes[bySlot[i]].slot = i;
+    }
+
+    vector<Process*> byArrival;
+    for (auto& p : processes) byArrival.push_back(&p);
+    stable_sort(byArrival.begin(), byArrival.end(), [](const Process* a, const Process* b) {
+        return a->arrivalTime < b->arrivalTime;
+    });
+
+    SlackTree slack(n);
+    priority_queue<Process*, vector<Process*>, CompareDeadline> readyQueue;
+    priority_queue<Process*, vector<Process*>, CompareDeadline> deferredQueue;
+
+    long long currentTime = 0;
+    long long blockedUntil = 0;
+    int index = 0;
+    Process* current = nullptr;
+
+    auto tracked = [&](const Process* p) {
+        return policy != ADMIT_ALL && p->status == ADMITTED;
+    };
+
+    while (index < n || current || !readyQueue.empty() || !deferredQueue.empty()) {
+        while (index < n && byArrival[index]->arrivalTime <= currentTime) {
+            Process* p = byArrival[index++];
+            if (policy == ADMIT_ALL || slack.tryAdmit(p->slot, p->deadline, p->burstTime, max(currentTime, blockedUntil))) {
+                readyQueue.push(p);
+            } else if (policy == ADMIT_DEFER) {
+                p->status = DEFERRED;
+                deferredQueue.push(p);
+            } else {
+                p->status = REJECTED;
+            }
+        }
+
+        if (!current) {
+            if (!readyQueue.empty()) {
+                current = readyQueue.top();
+                readyQueue.pop();
+            } else if (!deferredQueue.empty()) {
+                current = deferredQueue.top();
+                deferredQueue.pop();
+            } else if (index < n) {
+                currentTime = byArrival[index]->arrivalTime;
+                continue;
+            } else {
+                break;
+            }
+
+            if (!preemptive) {
+                blockedUntil = currentTime + current->remainingTime;
+                if (tracked(current)) {
+                    slack.consume(current->slot, current->remainingTime);
+                    slack.release(current->slot);
+                }
+            }
+        }
+
+        long long runUntil = currentTime + current->remainingTime;
+        if (index < n && byArrival[index]->arrivalTime < runUntil) {
+            runUntil = byArrival[index]->arrivalTime;
+        }
+        int ran = runUntil - currentTime;
+        current->remainingTime -= ran;
+        currentTime = runUntil;
+        if (preemptive && tracked(current)) {
+            slack.consume(current->slot, ran);
+        }
+
+        if (current->remainingTime == 0) {
+            if (preemptive && tracked(current)) {
+                slack.release(current->slot);
+            }
+            current->completionTime = currentTime;
+            current->turnaroundTime = current->completionTime - current->arrivalTime;
+            current->waitingTime = current->turnaroundTime - current->burstTime;
+            current->lateness = current->completionTime - current->deadline;
+            current = nullptr;
+        } else if (preemptive) {
+            (current->status == ADMITTED ? readyQueue : deferredQueue).push(current);
+            current = nullptr;
+        }
+    }
+
+    summary = {0, 0.0, INT_MIN, 0, 0};
+    int ran = 0;
+    for (const auto& p : processes) {
+        if (p.status == REJECTED) {
+            summary.rejected++;
+            continue;
+        }
+        if (p.status == DEFERRED) summary.deferred++;
+        ran++;
+        if (p.lateness > 0) summary.missCount++;
+        summary.maxLateness = max(summary.maxLateness, p.lateness);
+    }
+    summary.missRatio = ran > 0 ? (double)summary.missCount / ran : 0.0;
+    if (ran == 0) summary.maxLateness = 0;
+
+    return processes;
+}
+
+AdmissionPolicy parseAdmission(const string& s) {
+    if (s == "reject") return ADMIT_REJECT;
+    if (s == "defer") return ADMIT_DEFER;
+    return ADMIT_ALL;
+}
+
+void runAsService() {
+    string input;
+    while (getline(cin, input)) {
+        vector<string> fields;
+        size_t start = 0, sep;
+        while ((sep = input.find(';', start)) != string::npos) {
+            fields.push_back(input.substr(start, sep - start));
+            start = sep + 1;
+        }
+        fields.push_back(input.substr(start));
+        fields.resize(5);
+
+        vector<int> arrivals, bursts, deadlines;
+        vector<int>* columns[] = {&arrivals, &bursts, &deadlines};
+        for (int c = 0; c < 3; c++) {
+            char* token = strtok(const_cast<char*>(fields[c].c_str()), ",");
+            while (token) {
+                columns[c]->push_back(stoi(token));
+                token = strtok(nullptr, ",");
+            }
+        }
+
+        bool preemptive = fields[3] != "0";
+        AdmissionPolicy policy = parseAdmission(fields[4]);
+
+        EDFSummary summary;
+        auto results = calculateEDF(arrivals, bursts, deadlines, preemptive, policy, summary);
+
+        for (const auto& p : results) {
+            cout << p.id << ","
+                 << p.arrivalTime << ","
+                 << p.burstTime << ","
+                 << p.deadline << ","
+                 << p.completionTime << ","
+                 << p.turnaroundTime << ","
+                 << p.waitingTime << ","
+                 << p.lateness << ","
+                 << p.status << "|";
+        }
+        cout << ";" << summary.missCount << "," << summary.missRatio << "," << summary.maxLateness << ","
+             << summary.rejected << "," << summary.deferred << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--service") == 0) {
+        runAsService();
+    } else {
+        vector<int> arrivals = {0, 1, 2, 4};
+        vector<int> bursts = {5, 3, 8, 6};
+        vector<int> deadlines = {10, 5, 14, 12};
+
+        EDFSummary summary;
+        auto results = calculateEDF(arrivals, bursts, deadlines, true, ADMIT_REJECT, summary);
+
+        cout << "EDF (Preemptive, Reject) Results:\n";
+        cout << "PID\tArrival\tBurst\tDeadline\tCompletion\tTurnaround\tWaiting\tLateness\tStatus\n";
+        for (const auto& p : results) {
+            cout << p.id << "\t" << p.arrivalTime << "\t" << p.burstTime << "\t"
+                 << p.deadline << "\t\t" << p.completionTime << "\t\t"
+                 << p.turnaroundTime << "\t\t" << p.waitingTime << "\t"
+                 << p.lateness << "\t\t" << p.status << "\n";
+        }
+        cout << "Misses: " << summary.missCount << " (ratio " << summary.missRatio << ")\n";
+        cout << "Max Lateness: " << summary.maxLateness << "\n";
+        cout << "Rejected: " << summary.rejected << ", Deferred: " << summary.deferred << "\n";
+    }
+    return 0;
+}
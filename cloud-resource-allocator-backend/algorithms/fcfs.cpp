@@ -6,44 +6,18 @@
 #include <string>
 #include <cstring>
 
-using namespace std;
+#include "scheduler.h"
+#include "wasm.h"
 
-struct Process {
-    int id;
-    int arrivalTime;
-    int burstTime;
-    int completionTime;
-    int turnaroundTime;
-    int waitingTime;
-};
+using namespace std;
 
 vector<Process> calculateFCFS(const vector<int>& arrivals, const vector<int>& bursts) {
-    vector<Process> processes;
-    int n = arrivals.size();
-    
-    for (int i = 0; i < n; i++) {
-        processes.push_back({i + 1, arrivals[i], bursts[i], 0, 0, 0});
-    }
-    
-    sort(processes.begin(), processes.end(), 
-        [](const Process& a, const Process& b) { 
-            return a.arrivalTime < b.arrivalTime; 
-        });
-    
-    int currentTime = 0;
-    for (auto& p : processes) {
-        if (currentTime < p.arrivalTime) {
-            currentTime = p.arrivalTime;
-        }
-        
-        p.completionTime = currentTime + p.burstTime;
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        p.waitingTime = currentTime - p.arrivalTime;
-        
-        currentTime = p.completionTime;
-    }
-    
-    return processes;
+    vector<Process> processes = makeProcesses(arrivals, bursts);
+
+    CompletionLog log;
+    simulate<FifoQueue, NonPreemptive, RunToCompletion>(processes, log);
+
+    return log.order;
 }
 
 void runAsService() {
@@ -76,6 +50,21 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes 6 ints per process to out, in the same order as the service output.
+WASM_EXPORT int schedule(const int* arrivals, const int* bursts, int n, int* out) {
+    auto results = calculateFCFS(vector<int>(arrivals, arrivals + n), vector<int>(bursts, bursts + n));
+    for (const auto& p : results) {
+        *out++ = p.id;
+        *out++ = p.arrivalTime;
+        *out++ = p.burstTime;
+        *out++ = p.completionTime;
+        *out++ = p.turnaroundTime;
+        *out++ = p.waitingTime;
+    }
+    return results.size();
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -94,4 +83,5 @@ int main(int argc, char* argv[]) {
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
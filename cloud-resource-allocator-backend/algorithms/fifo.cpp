@@ -6,6 +6,9 @@
 #include <string>
 #include <cstring>
 
+#include "sharded.h"
+#include "wasm.h"
+
 using namespace std;
 
 struct PageResult {
@@ -13,42 +16,89 @@ struct PageResult {
     int pageFaults;
 };
 
-PageResult calculateFIFO(int ramSlots, const vector<int>& diskPages) {
+// FIFO frames of one cache. replay() continues from the frames the previous
+// call left, so a trace can be fed in pieces (see sharded.h).
+struct FIFOCache {
+    int ramSlots;
     queue<int> pageQueue;
     unordered_set<int> pageSet;
-    int hits = 0;
-    int faults = 0;
+    int hits;
+    int faults;
 
-    for (int page : diskPages) {
-        if (pageSet.find(page) != pageSet.end()) {
-            ++hits;
-            continue;
-        }
+    FIFOCache(int slots) : ramSlots(slots), hits(0), faults(0) {}
 
-        ++faults;
-        
-        if (pageQueue.size() == ramSlots) {
-            int oldest = pageQueue.front();
-            pageQueue.pop();
-            pageSet.erase(oldest);
+    void replay(const vector<int>& diskPages) {
+        if (ramSlots <= 0) {
+            faults += diskPages.size();
+            return;
         }
 
-        pageSet.insert(page);
-        pageQueue.push(page);
+        for (int page : diskPages) {
+            if (pageSet.find(page) != pageSet.end()) {
+                ++hits;
+                continue;
+            }
+
+            ++faults;
+            
+            if (pageQueue.size() == ramSlots) {
+                int oldest = pageQueue.front();
+                pageQueue.pop();
+                pageSet.erase(oldest);
+            }
+
+            pageSet.insert(page);
+            pageQueue.push(page);
+        }
     }
+};
 
-    return {hits, faults};
+PageResult calculateFIFO(int ramSlots, const vector<int>& diskPages) {
+    FIFOCache cache(ramSlots);
+    cache.replay(diskPages);
+    return {cache.hits, cache.faults};
 }
 
 void runAsService() {
-    string input;
-    while (getline(cin, input)) {
-        size_t sep = input.find(';');
-        int ramSlots = stoi(input.substr(0, sep));
+    ios::sync_with_stdio(false);
+    
+    string field;
+    while (getline(cin, field, ';')) {
+        // Sharded mode: sharded;ramSlots;tenant:slots,...;tenant:page,tenant:page,...
+        // The trace comes last so it can be parsed while it is still arriving.
+        if (field == "sharded") {
+            string slots_str, quotas_str;
+            getline(cin, slots_str, ';');
+            getline(cin, quotas_str, ';');
+            
+            auto quotas = parseQuotas(quotas_str);
+            bool malformed;
+            auto results = replaySharded<FIFOCache>(cin, stoi(slots_str), quotas, malformed);
+            if (malformed) {
+                cout << "error;expected tenant:page pairs" << endl;
+                continue;
+            }
+            
+            long long hits = 0, faults = 0;
+            for (const auto& r : results) {
+                hits += r.pageHits;
+                faults += r.pageFaults;
+            }
+            
+            cout << hits << "," << faults << ";";
+            for (const auto& r : results) {
+                cout << r.tenant << "," << r.pageHits << "," << r.pageFaults << "|";
+            }
+            cout << endl;
+            continue;
+        }
+        
+        int ramSlots = stoi(field);
         
         vector<int> diskPages;
         
-        string pages_str = input.substr(sep + 1);
+        string pages_str;
+        getline(cin, pages_str);
         char* token = strtok(const_cast<char*>(pages_str.c_str()), ",");
         while (token) {
             diskPages.push_back(stoi(token));
@@ -61,6 +111,14 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes page hits and page faults to out[0] and out[1].
+WASM_EXPORT void replacePages(int ramSlots, const int* diskPages, int n, int* out) {
+    auto result = calculateFIFO(ramSlots, vector<int>(diskPages, diskPages + n));
+    out[0] = result.pageHits;
+    out[1] = result.pageFaults;
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -75,4 +133,5 @@ int main(int argc, char* argv[]) {
         cout << "Page Faults: " << result.pageFaults << "\n";
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -5,78 +5,18 @@
 #include <string>
 #include <cstring>
 
+#include "scheduler.h"
+#include "wasm.h"
+
 using namespace std;
 
-struct Process {
-    int id;
-    int arrivalTime;
-    int burstTime;
-    int priority;
-    int completionTime;
-    int turnaroundTime;
-    int waitingTime;
-};
+vector<Process> calculatePriority(const vector<int>& arrivals, const vector<int>& bursts, const vector<int>& priorities) {
+    vector<Process> processes = makeProcesses(arrivals, bursts, priorities);
 
-struct ComparePriority {
-    bool operator()(const Process& a, const Process& b) {
-        if (a.priority == b.priority) {
-            return a.arrivalTime > b.arrivalTime; 
-        }
-        return a.priority > b.priority; 
-    }
-};
+    CompletionLog log;
+    simulate<HeapQueue<HighestPriority>, NonPreemptive, RunToCompletion>(processes, log);
 
-vector<Process> calculatePriority(const vector<int>& arrivals, const vector<int>& bursts, const vector<int>& priorities) {
-    vector<Process> processes;
-    int n = arrivals.size();
-    
-    for (int i = 0; i < n; i++) {
-        processes.push_back({i + 1, arrivals[i], bursts[i], priorities[i], 0, 0, 0});
-    }
-    
-    sort(processes.begin(), processes.end(), 
-        [](const Process& a, const Process& b) { 
-            return a.arrivalTime < b.arrivalTime; 
-        });
-    
-    priority_queue<Process, vector<Process>, ComparePriority> readyQueue;
-    vector<Process> results;
-    int currentTime = 0;
-    int index = 0;
-    
-    while (index < n || !readyQueue.empty()) {
-        while (index < n && processes[index].arrivalTime <= currentTime) {
-            readyQueue.push(processes[index]);
-            index++;
-        }
-        
-        if (!readyQueue.empty()) {
-            Process current = readyQueue.top();
-            readyQueue.pop();
-            
-            if (currentTime < current.arrivalTime) {
-                currentTime = current.arrivalTime;
-            }
-            
-            current.completionTime = currentTime + current.burstTime;
-            current.turnaroundTime = current.completionTime - current.arrivalTime;
-            current.waitingTime = current.turnaroundTime - current.burstTime;
-            
-            results.push_back(current);
-            currentTime = current.completionTime;
-        } else {
-            if (index < n) {
-                currentTime = processes[index].arrivalTime;
-            }
-        }
-    }
-    
-    sort(results.begin(), results.end(),
-        [](const Process& a, const Process& b) {
-            return a.completionTime < b.completionTime;
-        });
-    
-    return results;
+    return log.order;
 }
 
 void runAsService() {
@@ -87,19 +27,22 @@ void runAsService() {
         
         vector<int> arrivals, bursts, priorities;
         
-        char* token = strtok(const_cast<char*>(input.substr(0, sep1).c_str()), ",");
+        string arrivals_str = input.substr(0, sep1);
+        char* token = strtok(const_cast<char*>(arrivals_str.c_str()), ",");
         while (token) {
             arrivals.push_back(stoi(token));
             token = strtok(nullptr, ",");
         }
         
-        token = strtok(const_cast<char*>(input.substr(sep1 + 1, sep2 - (sep1 + 1)).c_str()), ",");
+        string bursts_str = input.substr(sep1 + 1, sep2 - (sep1 + 1));
+        token = strtok(const_cast<char*>(bursts_str.c_str()), ",");
         while (token) {
             bursts.push_back(stoi(token));
             token = strtok(nullptr, ",");
         }
         
-        token = strtok(const_cast<char*>(input.substr(sep2 + 1).c_str()), ",");
+        string priorities_str = input.substr(sep2 + 1);
+        token = strtok(const_cast<char*>(priorities_str.c_str()), ",");
         while (token) {
             priorities.push_back(stoi(token));
             token = strtok(nullptr, ",");
@@ -120,6 +63,23 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes 7 ints per process to out, in the same order as the service output.
+WASM_EXPORT int schedule(const int* arrivals, const int* bursts, const int* priorities, int n, int* out) {
+    auto results = calculatePriority(vector<int>(arrivals, arrivals + n), vector<int>(bursts, bursts + n),
+                                     vector<int>(priorities, priorities + n));
+    for (const auto& p : results) {
+        *out++ = p.id;
+        *out++ = p.arrivalTime;
+        *out++ = p.burstTime;
+        *out++ = p.priority;
+        *out++ = p.completionTime;
+        *out++ = p.turnaroundTime;
+        *out++ = p.waitingTime;
+    }
+    return results.size();
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -138,4 +98,5 @@ int main(int argc, char* argv[]) {
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
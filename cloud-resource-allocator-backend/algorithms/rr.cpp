@@ -7,69 +7,17 @@
 #include <string>
 #include <cstring>
 
+#include "scheduler.h"
+#include "wasm.h"
+
 using namespace std;
 
 const int TIME_QUANTUM = 3;
 
-struct Process {
-    int id;
-    int arrivalTime;
-    int burstTime;
-    int remainingTime;
-    int completionTime;
-    int turnaroundTime;
-    int waitingTime;
-};
-
 vector<Process> calculateRR(const vector<int>& arrivals, const vector<int>& bursts) {
-    vector<Process> processes;
-    int n = arrivals.size();
-    
-    for (int i = 0; i < n; i++) {
-        processes.push_back({i+1, arrivals[i], bursts[i], bursts[i], 0, 0, 0});
-    }
-
-    queue<Process*> readyQueue;
-    int currentTime = 0;
-    int completed = 0;
-    Process* current = nullptr;
-    int quantumUsed = 0;
-
-    while (completed < n) {
-        for (auto& p : processes) {
-            if (p.arrivalTime == currentTime && p.remainingTime > 0) {
-                readyQueue.push(&p);
-            }
-        }
-
-        if (current && (quantumUsed >= TIME_QUANTUM || current->remainingTime == 0)) {
-            if (current->remainingTime > 0) {
-                readyQueue.push(current); 
-            }
-            current = nullptr;
-        }
+    vector<Process> processes = makeProcesses(arrivals, bursts);
 
-        if (!current && !readyQueue.empty()) {
-            current = readyQueue.front();
-            readyQueue.pop();
-            quantumUsed = 0;
-        }
-
-        if (current) {
-            current->remainingTime--;
-            quantumUsed++;
-            
-            if (current->remainingTime == 0) {
-                current->completionTime = currentTime + 1;
-                current->turnaroundTime = current->completionTime - current->arrivalTime;
-                current->waitingTime = current->turnaroundTime - current->burstTime;
-                completed++;
-                current = nullptr;
-            }
-        }
-
-        currentTime++;
-    }
+    simulate<FifoQueue, NonPreemptive, FixedQuantum<TIME_QUANTUM>>(processes);
 
     return processes;
 }
@@ -80,13 +28,15 @@ void runAsService() {
         size_t sep = input.find(';');
         vector<int> arrivals, bursts;
         
-        char* token = strtok(const_cast<char*>(input.substr(0, sep).c_str()), ",");
+        string arrivals_str = input.substr(0, sep);
+        char* token = strtok(const_cast<char*>(arrivals_str.c_str()), ",");
         while (token) {
             arrivals.push_back(stoi(token));
             token = strtok(nullptr, ",");
         }
         
-        token = strtok(const_cast<char*>(input.substr(sep + 1).c_str()), ",");
+        string bursts_str = input.substr(sep + 1);
+        token = strtok(const_cast<char*>(bursts_str.c_str()), ",");
         while (token) {
             bursts.push_back(stoi(token));
             token = strtok(nullptr, ",");
@@ -102,6 +52,21 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes 6 ints per process to out, in the same order as the service output.
+WASM_EXPORT int schedule(const int* arrivals, const int* bursts, int n, int* out) {
+    auto results = calculateRR(vector<int>(arrivals, arrivals + n), vector<int>(bursts, bursts + n));
+    for (const auto& p : results) {
+        *out++ = p.id;
+        *out++ = p.arrivalTime;
+        *out++ = p.burstTime;
+        *out++ = p.completionTime;
+        *out++ = p.turnaroundTime;
+        *out++ = p.waitingTime;
+    }
+    return results.size();
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -119,4 +84,5 @@ int main(int argc, char* argv[]) {
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,192 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <vector>
+#include <algorithm>
+#include <queue>
+#include <climits>
+
+using namespace std;
+
+struct Process {
+    int id;
+    int arrivalTime;
+    int burstTime;
+    int priority;
+    int remainingTime;
+    int completionTime;
+    int turnaroundTime;
+    int waitingTime;
+};
+
+inline vector<Process> makeProcesses(const vector<int>& arrivals, const vector<int>& bursts,
+                                     const vector<int>& priorities = {}) {
+    vector<Process> processes;
+    int n = arrivals.size();
+
+    for (int i = 0; i < n; i++) {
+        int priority = i < (int)priorities.size() ? priorities[i] : 0;
+        processes.push_back({i + 1, arrivals[i], bursts[i], priority, bursts[i], 0, 0, 0});
+    }
+
+    return processes;
+}
+
+// Ready-queue policies. A policy exposes push/top/pop/empty over Process*.
+
+struct FifoQueue {
+    queue<Process*> q;
+
+    void push(Process* p) { q.push(p); }
+    Process* top() const { return q.front(); }
+    void pop() { q.pop(); }
+    bool empty() const { return q.empty(); }
+};
+
+template <typename Compare>
+struct HeapQueue {
+    using compare_type = Compare;
+    priority_queue<Process*, vector<Process*>, Compare> q;
+
+    void push(Process* p) { q.push(p); }
+    Process* top() const { return q.top(); }
+    void pop() { q.pop(); }
+    bool empty() const { return q.empty(); }
+};
+
+// Comparators follow priority_queue convention: true when a runs after b.
+
+struct ShortestBurst {
+    bool operator()(const Process* a, const Process* b) const {
+        return a->burstTime > b->burstTime;
+    }
+};
+
+struct ShortestRemaining {
+    bool operator()(const Process* a, const Process* b) const {
+        return a->remainingTime > b->remainingTime;
+    }
+};
+
+struct HighestPriority {
+    bool operator()(const Process* a, const Process* b) const {
+        if (a->priority == b->priority) {
+            return a->arrivalTime > b->arrivalTime;
+        }
+        return a->priority > b->priority;
+    }
+};
+
+// Preemption rules, checked whenever a job arrives while another is running.
+
+struct NonPreemptive {
+    static constexpr bool enabled = false;
+
+    template <typename ReadyQueue>
+    static bool shouldPreempt(const Process*, const Process*) { return false; }
+};
+
+struct PreemptByQueueOrder {
+    static constexpr bool enabled = true;
+
+    template <typename ReadyQueue>
+    static bool shouldPreempt(const Process* running, const Process* candidate) {
+        return typename ReadyQueue::compare_type()(running, candidate);
+    }
+};
+
+// Quantum policies. A sliced job that expires goes to the back of the ready
+// queue after any jobs that arrived during its slice.
+
+struct RunToCompletion {
+    static constexpr bool sliced = false;
+    static constexpr int quantum = INT_MAX;
+};
+
+template <int Q>
+struct FixedQuantum {
+    static constexpr bool sliced = true;
+    static constexpr int quantum = Q;
+};
+
+// Metric sinks observe dispatches and completions; any number may be attached.
+
+struct CompletionLog {
+    vector<Process> order;
+
+    void onDispatch(const Process&, int) {}
+    void onComplete(const Process& p, int) { order.push_back(p); }
+};
+
+// Event-driven single-CPU simulation. Time jumps straight to the next
+// arrival, completion or quantum expiry, so the cost is O(events * log n)
+// regardless of burst lengths. Policies are resolved at compile time and the
+// whole loop inlines per combination.
+template <typename ReadyQueue, typename Preemption, typename Quantum, typename... Sinks>
+void simulate(vector<Process>& processes, Sinks&... sinks) {
+    int n = processes.size();
+
+    vector<Process*> byArrival;
+    for (auto& p : processes) byArrival.push_back(&p);
+    stable_sort(byArrival.begin(), byArrival.end(), [](const Process* a, const Process* b) {
+        return a->arrivalTime < b->arrivalTime;
+    });
+
+    ReadyQueue readyQueue;
+    int currentTime = 0;
+    int index = 0;
+    int sliceEnd = 0;
+    Process* current = nullptr;
+
+    auto admitArrivals = [&]() {
+        while (index < n && byArrival[index]->arrivalTime <= currentTime) {
+            readyQueue.push(byArrival[index++]);
+        }
+    };
+
+    while (index < n || current || !readyQueue.empty()) {
+        admitArrivals();
+
+        if (Preemption::enabled && current && !readyQueue.empty() &&
+            Preemption::template shouldPreempt<ReadyQueue>(current, readyQueue.top())) {
+            readyQueue.push(current);
+            current = nullptr;
+        }
+
+        if (!current) {
+            if (readyQueue.empty()) {
+                currentTime = max(currentTime, byArrival[index]->arrivalTime);
+                continue;
+            }
+            current = readyQueue.top();
+            readyQueue.pop();
+            sliceEnd = Quantum::sliced ? currentTime + Quantum::quantum : INT_MAX;
+            (sinks.onDispatch(*current, currentTime), ...);
+        }
+
+        int runUntil = currentTime + current->remainingTime;
+        if (Quantum::sliced) {
+            runUntil = min(runUntil, sliceEnd);
+        }
+        if (Preemption::enabled && index < n) {
+            runUntil = min(runUntil, byArrival[index]->arrivalTime);
+        }
+
+        current->remainingTime -= runUntil - currentTime;
+        currentTime = runUntil;
+
+        if (current->remainingTime <= 0) {
+            current->completionTime = currentTime;
+            current->turnaroundTime = current->completionTime - current->arrivalTime;
+            current->waitingTime = current->turnaroundTime - current->burstTime;
+            (sinks.onComplete(*current, currentTime), ...);
+            current = nullptr;
+        } else if (Quantum::sliced && currentTime >= sliceEnd) {
+            admitArrivals();
+            readyQueue.push(current);
+            current = nullptr;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef SHARDED_H
+#define SHARDED_H
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <istream>
+
+using namespace std;
+
+struct TenantPageResult {
+    int tenant;
+    int pageHits;
+    int pageFaults;
+};
+
+// One cache per tenant, in order of first appearance. Cache is constructed
+// from a slot count, exposes hits and faults, and replay(pages) continues from
+// the state the previous call left, so a trace can be fed in pieces.
+// malformed is set when a token is not "tenant:page".
+template <typename Cache>
+struct ShardedCaches {
+    unordered_map<int, int> shardOf;
+    vector<int> tenants;
+    vector<Cache> caches;
+    bool malformed;
+};
+
+// Tenant buckets filled by one parser thread from its slice of a block.
+struct TraceBuckets {
+    unordered_map<int, int> bucketOf;
+    vector<int> tenants;
+    vector<vector<int>> pages;
+    bool malformed;
+};
+
+// Trace text is read and parsed this many bytes at a time.
+const size_t TRACE_BLOCK = 1 << 24;
+
+// Runs task(0), ..., task(count - 1) on up to hardware_concurrency threads,
+// each claiming the next index from an atomic counter.
+template <typename Task>
+void parallelFor(size_t count, Task task) {
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next.fetch_add(1)) < count) {
+            task(i);
+        }
+    };
+
+    size_t threadCount = min<size_t>(max(thread::hardware_concurrency(), 1u), count);
+    vector<thread> pool;
+    for (size_t i = 1; i < threadCount; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
+// Parses "tenant:slots,tenant:slots,..." into a quota table.
+inline unordered_map<int, int> parseQuotas(const string& quotas_str) {
+    unordered_map<int, int> quotas;
+    string copy = quotas_str;
+    char* token = strtok(const_cast<char*>(copy.c_str()), ",");
+    while (token) {
+        char* colon = strchr(token, ':');
+        if (colon) {
+            *colon = '\0';
+            quotas[stoi(token)] = stoi(colon + 1);
+        }
+        token = strtok(nullptr, ",");
+    }
+    return quotas;
+}
+
+// Parses "tenant:page,tenant:page,..." in [p, end). The last token must be
+// followed by ',' or '\0' so that strtol stops there.
+inline void parseTraceRange(const char* p, const char* end, TraceBuckets& out) {
+    while (p < end) {
+        char* colon;
+        long tenant = strtol(p, &colon, 10);
+        if (colon == p || *colon != ':') {
+            out.malformed = true;
+            return;
+        }
+
+        char* next;
+        long page = strtol(colon + 1, &next, 10);
+        if (next == colon + 1 || (next < end && *next != ',')) {
+            out.malformed = true;
+            return;
+        }
+
+        auto it = out.bucketOf.find(tenant);
+        if (it == out.bucketOf.end()) {
+            it = out.bucketOf.emplace(tenant, out.pages.size()).first;
+            out.tenants.push_back(tenant);
+            out.pages.emplace_back();
+        }
+        out.pages[it->second].push_back(page);
+        p = next + 1;
+    }
+}
+
+// Splits [0, length) of block at commas into one slice per thread and parses
+// the slices in parallel. Each tenant's buckets are then replayed into its
+// cache in thread order, so every cache sees its references in trace order;
+// tenants are replayed in parallel, and the buckets are freed as they go.
+template <typename Cache>
+void replayTraceBlock(const char* block, size_t length, ShardedCaches<Cache>& sharded,
+                      int defaultSlots, const unordered_map<int, int>& quotas) {
+    size_t parts = max(thread::hardware_concurrency(), 1u);
+    vector<size_t> bounds(parts + 1, length);
+    bounds[0] = 0;
+    for (size_t i = 1; i < parts; i++) {
+        size_t b = max(bounds[i - 1], length * i / parts);
+        while (b > 0 && b < length && block[b - 1] != ',') b++;
+        bounds[i] = b;
+    }
+
+    vector<TraceBuckets> buckets(parts);
+    parallelFor(parts, [&](size_t i) {
+        buckets[i].malformed = false;
+        parseTraceRange(block + bounds[i], block + bounds[i + 1], buckets[i]);
+    });
+
+    // Registering tenants thread by thread preserves first-appearance order.
+    vector<vector<pair<int, int>>> sources;
+    vector<int> touched;
+    unordered_map<int, int> sourceOf;
+    for (size_t t = 0; t < parts; t++) {
+        sharded.malformed |= buckets[t].malformed;
+        for (size_t b = 0; b < buckets[t].tenants.size(); b++) {
+            int tenant = buckets[t].tenants[b];
+            auto it = sharded.shardOf.find(tenant);
+            if (it == sharded.shardOf.end()) {
+                auto quota = quotas.find(tenant);
+                it = sharded.shardOf.emplace(tenant, sharded.caches.size()).first;
+                sharded.tenants.push_back(tenant);
+                sharded.caches.emplace_back(quota != quotas.end() ? quota->second : defaultSlots);
+            }
+            auto source = sourceOf.find(it->second);
+            if (source == sourceOf.end()) {
+                source = sourceOf.emplace(it->second, sources.size()).first;
+                touched.push_back(it->second);
+                sources.emplace_back();
+            }
+            sources[source->second].push_back({(int)t, (int)b});
+        }
+    }
+    if (sharded.malformed) return;
+
+    parallelFor(touched.size(), [&](size_t k) {
+        Cache& cache = sharded.caches[touched[k]];
+        for (const auto& source : sources[k]) {
+            vector<int>& pages = buckets[source.first].pages[source.second];
+            cache.replay(pages);
+            vector<int>().swap(pages);
+        }
+    });
+}
+
+// Reads the rest of the current line from in as "tenant:page,..." one block
+// at a time and replays each block before reading the next. Tenants never
+// share frames, so each tenant is an independent cache and results are
+// identical to replaying the tenants one by one; tenants without an entry in
+// quotas get defaultSlots. Memory is bounded by the block, its buckets and
+// the per-tenant frames, not by the trace length. The token cut off at the
+// end of a block is carried over to the next one. Reading is serial; use an
+// unsynced stream (ios::sync_with_stdio(false)) so it is not done a character
+// at a time. Output is ordered by first appearance in the trace.
+template <typename Cache>
+vector<TenantPageResult> replaySharded(istream& in, int defaultSlots,
+                                       const unordered_map<int, int>& quotas, bool& malformed) {
+    ShardedCaches<Cache> sharded;
+    sharded.malformed = false;
+    vector<char> block(TRACE_BLOCK + 1);
+    size_t carry = 0;
+    bool lineDone = false;
+
+    while (!lineDone) {
+        // getline fails without reaching the newline when the block is full.
+        in.getline(block.data() + carry, TRACE_BLOCK + 1 - carry);
+        size_t length = carry + in.gcount();
+        if (in.fail() && !in.eof()) {
+            in.clear();
+        } else {
+            lineDone = true;
+            if (!in.eof()) length--;
+        }
+        block[length] = '\0';
+
+        size_t parsed = length;
+        if (!lineDone) {
+            while (parsed > 0 && block[parsed - 1] != ',') parsed--;
+            if (parsed == 0) {
+                // A single token filled the block; skip it.
+                sharded.malformed = true;
+                carry = 0;
+                continue;
+            }
+            parsed--;
+        }
+
+        if (!sharded.malformed) {
+            replayTraceBlock(block.data(), parsed, sharded, defaultSlots, quotas);
+        }
+
+        carry = lineDone ? 0 : length - (parsed + 1);
+        memmove(block.data(), block.data() + parsed + 1, carry);
+    }
+
+    malformed = sharded.malformed;
+    vector<TenantPageResult> results;
+    for (size_t s = 0; s < sharded.caches.size(); s++) {
+        results.push_back({sharded.tenants[s], sharded.caches[s].hits, sharded.caches[s].faults});
+    }
+    return results;
+}
+
+#endif
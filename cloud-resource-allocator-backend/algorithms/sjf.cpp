@@ -7,75 +7,18 @@
 #include <cstring>
 #include <queue>
 
+#include "scheduler.h"
+#include "wasm.h"
+
 using namespace std;
 
-struct Process {
-    int id;
-    int arrivalTime;
-    int burstTime;
-    int completionTime;
-    int turnaroundTime;
-    int waitingTime;
-};
+vector<Process> calculateSJF(const vector<int>& arrivals, const vector<int>& bursts) {
+    vector<Process> processes = makeProcesses(arrivals, bursts);
 
-struct CompareBurst {
-    bool operator()(const Process& a, const Process& b) {
-        return a.burstTime > b.burstTime;
-    }
-};
+    CompletionLog log;
+    simulate<HeapQueue<ShortestBurst>, NonPreemptive, RunToCompletion>(processes, log);
 
-vector<Process> calculateSJF(const vector<int>& arrivals, const vector<int>& bursts) {
-    vector<Process> processes;
-    int n = arrivals.size();
-    
-    for (int i = 0; i < n; i++) {
-        processes.push_back({i + 1, arrivals[i], bursts[i], 0, 0, 0});
-    }
-    
-    sort(processes.begin(), processes.end(), 
-        [](const Process& a, const Process& b) { 
-            return a.arrivalTime < b.arrivalTime; 
-        });
-    
-    priority_queue<Process, vector<Process>, CompareBurst> readyQueue;
-    
-    vector<Process> results;
-    int currentTime = 0;
-    int index = 0;
-    
-    while (index < n || !readyQueue.empty()) {
-        while (index < n && processes[index].arrivalTime <= currentTime) {
-            readyQueue.push(processes[index]);
-            index++;
-        }
-        
-        if (!readyQueue.empty()) {
-            Process current = readyQueue.top();
-            readyQueue.pop();
-            
-            if (currentTime < current.arrivalTime) {
-                currentTime = current.arrivalTime;
-            }
-            
-            current.completionTime = currentTime + current.burstTime;
-            current.turnaroundTime = current.completionTime - current.arrivalTime;
-            current.waitingTime = currentTime - current.arrivalTime;
-            
-            results.push_back(current);
-            currentTime = current.completionTime;
-        } else {
-            if (index < n) {
-                currentTime = processes[index].arrivalTime;
-            }
-        }
-    }
-    
-    sort(results.begin(), results.end(),
-        [](const Process& a, const Process& b) {
-            return a.completionTime < b.completionTime;
-        });
-    
-    return results;
+    return log.order;
 }
 
 void runAsService() {
@@ -108,6 +51,21 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes 6 ints per process to out, in the same order as the service output.
+WASM_EXPORT int schedule(const int* arrivals, const int* bursts, int n, int* out) {
+    auto results = calculateSJF(vector<int>(arrivals, arrivals + n), vector<int>(bursts, bursts + n));
+    for (const auto& p : results) {
+        *out++ = p.id;
+        *out++ = p.arrivalTime;
+        *out++ = p.burstTime;
+        *out++ = p.completionTime;
+        *out++ = p.turnaroundTime;
+        *out++ = p.waitingTime;
+    }
+    return results.size();
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -126,4 +84,5 @@ int main(int argc, char* argv[]) {
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
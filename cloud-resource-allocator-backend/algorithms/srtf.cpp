@@ -7,66 +7,15 @@
 #include <string>
 #include <cstring>
 
-using namespace std;
+#include "scheduler.h"
+#include "wasm.h"
 
-struct Process {
-    int id;
-    int arrivalTime;
-    int burstTime;
-    int remainingTime;
-    int completionTime;
-    int turnaroundTime;
-    int waitingTime;
-};
+using namespace std;
 
 vector<Process> calculateSRTF(const vector<int>& arrivals, const vector<int>& bursts) {
-    vector<Process> processes;
-    int n = arrivals.size();
-    
-    for (int i = 0; i < n; i++) {
-        processes.push_back({i+1, arrivals[i], bursts[i], bursts[i], 0, 0, 0});
-    }
+    vector<Process> processes = makeProcesses(arrivals, bursts);
 
-    auto comp = [](Process* a, Process* b) { 
-        return a->remainingTime > b->remainingTime; 
-    };
-    priority_queue<Process*, vector<Process*>, decltype(comp)> readyQueue(comp);
-
-    int currentTime = 0;
-    int completed = 0;
-    Process* current = nullptr;
-
-    while (completed < n) {
-        for (auto& p : processes) {
-            if (p.arrivalTime == currentTime && p.remainingTime > 0) {
-                readyQueue.push(&p);
-            }
-        }
-
-        if (current && !readyQueue.empty() && readyQueue.top()->remainingTime < current->remainingTime) {
-            readyQueue.push(current);
-            current = readyQueue.top();
-            readyQueue.pop();
-        }
-
-        if (!current && !readyQueue.empty()) {
-            current = readyQueue.top();
-            readyQueue.pop();
-        }
-
-        if (current) {
-            current->remainingTime--;
-            if (current->remainingTime == 0) {
-                current->completionTime = currentTime + 1;
-                current->turnaroundTime = current->completionTime - current->arrivalTime;
-                current->waitingTime = current->turnaroundTime - current->burstTime;
-                completed++;
-                current = nullptr;
-            }
-        }
-
-        ++currentTime;
-    }
+    simulate<HeapQueue<ShortestRemaining>, PreemptByQueueOrder, RunToCompletion>(processes);
 
     return processes;
 }
@@ -77,13 +26,15 @@ void runAsService() {
         size_t sep = input.find(';');
         vector<int> arrivals, bursts;
         
-        char* token = strtok(const_cast<char*>(input.substr(0, sep).c_str()), ",");
+        string arrivals_str = input.substr(0, sep);
+        char* token = strtok(const_cast<char*>(arrivals_str.c_str()), ",");
         while (token) {
             arrivals.push_back(stoi(token));
             token = strtok(nullptr, ",");
         }
         
-        token = strtok(const_cast<char*>(input.substr(sep + 1).c_str()), ",");
+        string bursts_str = input.substr(sep + 1);
+        token = strtok(const_cast<char*>(bursts_str.c_str()), ",");
         while (token) {
             bursts.push_back(stoi(token));
             token = strtok(nullptr, ",");
@@ -99,6 +50,21 @@ void runAsService() {
     }
 }
 
+#ifdef __EMSCRIPTEN__
+// Writes 6 ints per process to out, in the same order as the service output.
+WASM_EXPORT int schedule(const int* arrivals, const int* bursts, int n, int* out) {
+    auto results = calculateSRTF(vector<int>(arrivals, arrivals + n), vector<int>(bursts, bursts + n));
+    for (const auto& p : results) {
+        *out++ = p.id;
+        *out++ = p.arrivalTime;
+        *out++ = p.burstTime;
+        *out++ = p.completionTime;
+        *out++ = p.turnaroundTime;
+        *out++ = p.waitingTime;
+    }
+    return results.size();
+}
+#else
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "--service") == 0) {
         runAsService();
@@ -116,4 +82,5 @@ int main(int argc, char* argv[]) {
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,11 @@
+#ifndef WASM_H
+#define WASM_H
+
+// Under Emscripten each engine drops its stdin service and instead exports a
+// C entry point over typed-array buffers; see build-wasm.sh.
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#define WASM_EXPORT extern "C" EMSCRIPTEN_KEEPALIVE
+#endif
+
+#endif
@@ -1,10 +1,24 @@
 import express from "express"
 import cors from "cors"
 import { spawn } from "child_process"
+import { once } from "events"
+
+// Request bodies up to 64 MB. The frontend derives its job and page limits
+// from this size (BACKEND_BODY_BYTES in src/utils/wasmEngines.js): at worst
+// 12 bytes per value, so about 1.8M jobs or 5.5M page references.
+const JSON_BODY_LIMIT = '64mb';
+
+// Multi-tenant traces are larger. Up to 256 MB, about 15M jobs with their
+// tenant ids for /api/fairshare or 25M tenant-tagged page references for
+// /api/:algo/sharded.
+const BULK_BODY_LIMIT = '256mb';
+const BULK_ROUTES = ['/api/fairshare', '/api/:algo/sharded'];
 
 const app = express();
 app.use(cors());
-app.use(express.json());
+// Registered first: the general parser skips bodies that are already parsed.
+app.use(BULK_ROUTES, express.json({ limit: BULK_BODY_LIMIT }));
+app.use(express.json({ limit: JSON_BODY_LIMIT }));
 
 app.post('/api/fcfs', (req, res) => {
     const fcfsProcess = spawn('./algorithms/fcfs', ['--service']);
@@ -19,12 +33,14 @@ app.post('/api/fcfs', (req, res) => {
     
     fcfsProcess.stdin.write(input);
     
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         fcfsProcess.stdout.off('data', listener);
         
         try {
-            const processes = output.split('|')
+            const processes = output.trim().split('|')
                 .filter(x => x)
                 .map(procStr => {
                     const [id, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime] = 
@@ -34,7 +50,7 @@ app.post('/api/fcfs', (req, res) => {
             
             const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
             const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
-            const throughput = processes.length / Math.max(...processes.map(p => p.completionTime));
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
             
             res.json({
                 processes,
@@ -64,12 +80,14 @@ app.post('/api/sjf', (req, res) => {
     
     sjfProcess.stdin.write(input);
     
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         sjfProcess.stdout.off('data', listener);
         
         try {
-            const processes = output.split('|')
+            const processes = output.trim().split('|')
                 .filter(x => x)
                 .map(procStr => {
                     const [id, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime] = 
@@ -79,7 +97,7 @@ app.post('/api/sjf', (req, res) => {
             
             const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
             const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
-            const throughput = processes.length / Math.max(...processes.map(p => p.completionTime));
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
             
             res.json({
                 processes,
@@ -110,8 +128,10 @@ app.post('/api/priority', (req, res) => {
     
     priorityProcess.stdin.write(input);
     
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         priorityProcess.stdout.off('data', listener);
         
         try {
@@ -126,7 +146,7 @@ app.post('/api/priority', (req, res) => {
             
             const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
             const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
-            const throughput = processes.length / Math.max(...processes.map(p => p.completionTime));
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
 
             res.json({
                 processes,
@@ -156,12 +176,14 @@ app.post('/api/srtf', (req, res) => {
     
     srtfProcess.stdin.write(input);
     
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         srtfProcess.stdout.off('data', listener);
         
         try {
-            const processes = output.split('|')
+            const processes = output.trim().split('|')
                 .filter(x => x)
                 .map(procStr => {
                     const [id, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime] = 
@@ -171,7 +193,7 @@ app.post('/api/srtf', (req, res) => {
             
             const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
             const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
-            const throughput = processes.length / Math.max(...processes.map(p => p.completionTime));
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
             
             res.json({
                 processes,
@@ -200,12 +222,14 @@ app.post('/api/roundrobin', (req, res) => {
     
     rrProcess.stdin.write(input);
     
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         rrProcess.stdout.off('data', listener);
         
         try {
-            const processes = output.split('|')
+            const processes = output.trim().split('|')
                 .filter(x => x)
                 .map(procStr => {
                     const [id, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime] = 
@@ -215,7 +239,7 @@ app.post('/api/roundrobin', (req, res) => {
             
             const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
             const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
-            const throughput = processes.length / Math.max(...processes.map(p => p.completionTime));
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
             
             res.json({
                 processes,
@@ -231,6 +255,127 @@ app.post('/api/roundrobin', (req, res) => {
     rrProcess.stdout.on('data', listener);
 });
 
+app.post('/api/edf', (req, res) => {
+    const edfProcess = spawn('./algorithms/edf', ['--service']);
+
+    const { arrivals, bursts, deadlines, preemptive = true, admission = 'none' } = req.body;
+
+    if (!edfProcess || edfProcess.killed) {
+        return res.status(500).json({ error: "EDF service not available" });
+    }
+
+    const input = `${arrivals.join(',')};${bursts.join(',')};${deadlines.join(',')};${preemptive ? 1 : 0};${admission}\n`;
+
+    edfProcess.stdin.write(input);
+
+    let output = '';
+    const listener = (data) => {
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
+        edfProcess.stdout.off('data', listener);
+
+        try {
+            const [rows, summary] = output.trim().split(';');
+            const statuses = ['admitted', 'deferred', 'rejected'];
+            const processes = rows.split('|')
+                .filter(x => x)
+                .map(procStr => {
+                    const [id, arrivalTime, burstTime, deadline, completionTime, turnaroundTime, waitingTime, lateness, status] =
+                        procStr.split(',').map(Number);
+                    return { id, arrivalTime, burstTime, deadline, completionTime, turnaroundTime, waitingTime, lateness, status: statuses[status] };
+                });
+            const [missCount, missRatio, maxLateness, rejected, deferred] = summary.split(',').map(Number);
+
+            // Rejected jobs never run; with nothing completed there is nothing to average.
+            const completed = processes.filter(p => p.status !== 'rejected');
+            const makespan = completed.reduce((max, p) => Math.max(max, p.completionTime), 0);
+            const avgTurnaroundTime = completed.length ? completed.reduce((sum, p) => sum + p.turnaroundTime, 0) / completed.length : 0;
+            const avgWaitingTime = completed.length ? completed.reduce((sum, p) => sum + p.waitingTime, 0) / completed.length : 0;
+            const throughput = makespan > 0 ? completed.length / makespan : 0;
+
+            res.json({
+                processes,
+                avgTurnaroundTime,
+                avgWaitingTime,
+                throughput,
+                missCount,
+                missRatio,
+                maxLateness,
+                rejected,
+                deferred
+            });
+        } catch (err) {
+            res.status(500).json({ error: "Failed to parse EDF output" });
+        }
+    };
+
+    edfProcess.stdout.on('data', listener);
+});
+
+const MAX_TENANT_WEIGHT = 1 << 20;
+
+app.post('/api/fairshare', (req, res) => {
+    const { arrivals, bursts, tenants, weights } = req.body;
+
+    // Matches MAX_WEIGHT in algorithms/cfs.cpp.
+    if (!weights.every(w => Number.isInteger(w) && w >= 1 && w <= MAX_TENANT_WEIGHT)) {
+        return res.status(400).json({ error: `Weights must be integers in [1, ${MAX_TENANT_WEIGHT}]` });
+    }
+
+    const cfsProcess = spawn('./algorithms/cfs', ['--service']);
+
+    if (!cfsProcess || cfsProcess.killed) {
+        return res.status(500).json({ error: "Fair Share service not available" });
+    }
+
+    const input = `${arrivals.join(',')};${bursts.join(',')};${tenants.join(',')};${weights.join(',')}\n`;
+
+    cfsProcess.stdin.write(input);
+
+    // Output for large traces arrives in several chunks; parse once the line is complete.
+    let output = '';
+    const listener = (data) => {
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
+        cfsProcess.stdout.off('data', listener);
+
+        try {
+            const [rows, tenantRows, fairnessIndex] = output.trim().split(';');
+            const processes = rows.split('|')
+                .filter(x => x)
+                .map(procStr => {
+                    const [id, tenant, weight, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime, slowdown] =
+                        procStr.split(',').map(Number);
+                    return { id, tenant, weight, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime, slowdown };
+                });
+            const tenantStats = tenantRows.split('|')
+                .filter(x => x)
+                .map(tenantStr => {
+                    const [tenant, weight, jobs, cpuTime, share, normalizedShare, avgSlowdown] =
+                        tenantStr.split(',').map(Number);
+                    return { tenant, weight, jobs, cpuTime, share, normalizedShare, avgSlowdown };
+                });
+
+            const avgTurnaroundTime = processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length;
+            const avgWaitingTime = processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length;
+            const throughput = processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0);
+
+            res.json({
+                processes,
+                tenants: tenantStats,
+                fairnessIndex: Number(fairnessIndex),
+                avgTurnaroundTime,
+                avgWaitingTime,
+                throughput
+            });
+        } catch (err) {
+            res.status(500).json({ error: "Failed to parse Fair Share output" });
+        }
+    };
+
+    cfsProcess.stdout.on('data', listener);
+});
+
 
 app.post('/api/fifo', (req, res) => {
 
@@ -248,12 +393,14 @@ app.post('/api/fifo', (req, res) => {
     const input = `${ramSlots};${diskPages.join(',')}\n`;
     fifoProcess.stdin.write(input);
 
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         fifoProcess.stdout.off('data', listener);
 
         try {
-            const [pageHits, pageFaults] = output.split(',').map(Number);
+            const [pageHits, pageFaults] = output.trim().split(',').map(Number);
             
             res.json({
                 pageHits,
@@ -264,7 +411,7 @@ app.post('/api/fifo', (req, res) => {
         }
     };
 
-    fifoProcess.stdout.once('data', listener);
+    fifoProcess.stdout.on('data', listener);
 });
 
 app.post('/api/lru', (req, res) => {
@@ -283,12 +430,14 @@ app.post('/api/lru', (req, res) => {
     const input = `${ramSlots};${diskPages.join(',')}\n`;
     lruProcess.stdin.write(input);
 
+    let output = '';
     const listener = (data) => {
-        const output = data.toString().trim();
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
         lruProcess.stdout.off('data', listener);
 
         try {
-            const [pageHits, pageFaults] = output.split(',').map(Number);
+            const [pageHits, pageFaults] = output.trim().split(',').map(Number);
             
             res.json({
                 pageHits,
@@ -299,7 +448,85 @@ app.post('/api/lru', (req, res) => {
         }
     };
 
-    lruProcess.stdout.once('data', listener);
+    lruProcess.stdout.on('data', listener);
+});
+
+const TRACE_BATCH = 1 << 16;
+
+app.post('/api/:algo/sharded', (req, res) => {
+    const { algo } = req.params;
+    if (algo !== 'fifo' && algo !== 'lru') {
+        return res.status(404).json({ error: `No sharded mode for ${algo}` });
+    }
+
+    const { ramSlots, diskPages, tenants, quotas = {} } = req.body;
+
+    // ramSlots may be 0, which makes every reference a fault.
+    if (ramSlots === undefined || !diskPages || !tenants) {
+        return res.status(400).json({ error: "Missing ramSlots, diskPages or tenants" });
+    }
+
+    if (diskPages.length !== tenants.length) {
+        return res.status(400).json({ error: "diskPages and tenants must have the same length" });
+    }
+
+    const pagingProcess = spawn(`./algorithms/${algo}`, ['--service']);
+
+    if (!pagingProcess || pagingProcess.killed) {
+        return res.status(500).json({ error: `${algo.toUpperCase()} service not available` });
+    }
+
+    // The trace goes last as tenant:page pairs and is written in batches, so
+    // the engine starts parsing before the whole line has been built.
+    const writeTrace = async () => {
+        const quotaList = Object.entries(quotas).map(([tenant, slots]) => `${tenant}:${slots}`);
+        pagingProcess.stdin.write(`sharded;${ramSlots};${quotaList.join(',')};`);
+
+        for (let start = 0; start < diskPages.length; start += TRACE_BATCH) {
+            const end = Math.min(start + TRACE_BATCH, diskPages.length);
+            let batch = '';
+            for (let i = start; i < end; i++) {
+                batch += `${i ? ',' : ''}${tenants[i]}:${diskPages[i]}`;
+            }
+            if (!pagingProcess.stdin.write(batch)) {
+                await once(pagingProcess.stdin, 'drain');
+            }
+        }
+        pagingProcess.stdin.write('\n');
+    };
+    writeTrace();
+
+    let output = '';
+    const listener = (data) => {
+        output += data.toString();
+        if (!output.endsWith('\n')) return;
+        pagingProcess.stdout.off('data', listener);
+
+        if (output.startsWith('error;')) {
+            return res.status(400).json({ error: `Invalid trace: ${output.trim().slice('error;'.length)}` });
+        }
+
+        try {
+            const [totals, tenantRows] = output.trim().split(';');
+            const [pageHits, pageFaults] = totals.split(',').map(Number);
+            const perTenant = tenantRows.split('|')
+                .filter(x => x)
+                .map(tenantStr => {
+                    const [tenant, pageHits, pageFaults] = tenantStr.split(',').map(Number);
+                    return { tenant, pageHits, pageFaults };
+                });
+
+            res.json({
+                pageHits,
+                pageFaults,
+                tenants: perTenant
+            });
+        } catch (err) {
+            res.status(500).json({ error: `Failed to parse ${algo.toUpperCase()} output` });
+        }
+    };
+
+    pagingProcess.stdout.on('data', listener);
 });
 
 
@@ -94,30 +94,23 @@ function App() {
         return newPages;
       }
       else {
+        // Map keeps insertion order, so re-inserting on use leaves the LRU page first.
         if (prev.includes(id)) {
-          lruRef.current.set(id, Date.now());
-          return prev; 
+          lruRef.current.delete(id);
+          lruRef.current.set(id, true);
+          return prev;
         }
 
         if (prev.length < RAM_SLOTS) {
-          lruRef.current.set(id, Date.now());
+          lruRef.current.set(id, true);
           return [...prev, id];
         }
 
-        let lruPage = prev[0];
-        let minTime = lruRef.current.get(lruPage);
-    
-        for (const page of prev) {
-          const time = lruRef.current.get(page);
-          if (time < minTime) {
-            minTime = time;
-            lruPage = page;
-          }
-        }
+        const lruPage = lruRef.current.keys().next().value;
 
         const newPages = prev.map(p => p === lruPage ? id : p);
         lruRef.current.delete(lruPage);
-        lruRef.current.set(id, Date.now());
+        lruRef.current.set(id, true);
     
         return newPages;
       }
@@ -1,5 +1,16 @@
+import { BACKEND_JOB_LIMIT, LOCAL_JOB_LIMIT, runSchedulerLocally } from "./wasmEngines";
+
 export const calculateMetrics = async (jobs, algo) => {
   try {
+    if (jobs.length <= LOCAL_JOB_LIMIT) {
+      const local = await runSchedulerLocally(jobs, algo);
+      if (local) return local;
+    }
+
+    if (jobs.length > BACKEND_JOB_LIMIT) {
+      throw new Error(`At most ${BACKEND_JOB_LIMIT} jobs are supported`);
+    }
+
     const response = await fetch(`http://localhost:4000/api/${algo}`, {
       method: "POST",
       headers: { "Content-Type": "application/json" },
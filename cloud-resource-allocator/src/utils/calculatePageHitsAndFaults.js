@@ -1,6 +1,17 @@
+import { BACKEND_PAGE_LIMIT, LOCAL_PAGE_LIMIT, runPageReplacementLocally } from "./wasmEngines";
+
 export const calculatePagesHitsAndFaults = async (pages, ramSlots, algo) => {
   console.log(pages)
   try {
+    if (pages.length <= LOCAL_PAGE_LIMIT) {
+      const local = await runPageReplacementLocally(pages, ramSlots, algo);
+      if (local) return local;
+    }
+
+    if (pages.length > BACKEND_PAGE_LIMIT) {
+      throw new Error(`At most ${BACKEND_PAGE_LIMIT} page references are supported`);
+    }
+
     const response = await fetch(`http://localhost:4000/api/${algo}`, {
       method: "POST",
       headers: { "Content-Type": "application/json" },
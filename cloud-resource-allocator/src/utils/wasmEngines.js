@@ -0,0 +1,111 @@
+// Size budget shared with the backend, which accepts JSON bodies up to 64 MB
+// (JSON_BODY_LIMIT in cloud-resource-allocator-backend/index.js). A 32-bit
+// value costs at most 12 bytes of JSON (sign, 10 digits and a comma), a job
+// sends three values, and 1 KB is kept for keys and brackets. Inputs up to the
+// BACKEND_* limits always fit in one request; the browser only runs inputs up
+// to 1/32 of that and leaves the rest to the backend.
+export const BACKEND_BODY_BYTES = 64 * 1024 * 1024;
+const ENVELOPE_BYTES = 1024;
+const VALUE_BYTES = 12;
+const LOCAL_SHARE = 32;
+
+export const BACKEND_JOB_LIMIT = Math.floor((BACKEND_BODY_BYTES - ENVELOPE_BYTES) / (3 * VALUE_BYTES));
+export const BACKEND_PAGE_LIMIT = Math.floor((BACKEND_BODY_BYTES - ENVELOPE_BYTES) / VALUE_BYTES);
+export const LOCAL_JOB_LIMIT = Math.floor(BACKEND_JOB_LIMIT / LOCAL_SHARE);
+export const LOCAL_PAGE_LIMIT = Math.floor(BACKEND_PAGE_LIMIT / LOCAL_SHARE);
+
+const MODULES = {
+  fcfs: "fcfs",
+  sjf: "sjf",
+  srtf: "srtf",
+  priority: "priority",
+  roundrobin: "rr",
+  fifo: "fifo",
+  lru: "lru",
+};
+
+const engines = new Map();
+
+// Resolves to null when the module has not been built (see build-wasm.sh) or
+// lacks the heap and allocator exports, so callers fall back to the backend.
+const loadEngine = (algo) => {
+  const name = MODULES[algo];
+  if (!name) return Promise.resolve(null);
+
+  if (!engines.has(name)) {
+    engines.set(
+      name,
+      import(/* @vite-ignore */ `${import.meta.env.BASE_URL}wasm/${name}.js`)
+        .then((module) => module.default())
+        .then((engine) => (engine.HEAP32 && engine._malloc && engine._free ? engine : null))
+        .catch(() => null)
+    );
+  }
+  return engines.get(name);
+};
+
+const withBuffers = (engine, inputs, outLength, run) => {
+  const pointers = inputs.map((values) => {
+    const ptr = engine._malloc(Math.max(values.length, 1) * 4);
+    engine.HEAP32.set(values, ptr >> 2);
+    return ptr;
+  });
+  const outPtr = engine._malloc(Math.max(outLength, 1) * 4);
+
+  try {
+    const count = run(pointers, outPtr);
+    return { count, out: engine.HEAP32.slice(outPtr >> 2, (outPtr >> 2) + outLength) };
+  } finally {
+    pointers.forEach((ptr) => engine._free(ptr));
+    engine._free(outPtr);
+  }
+};
+
+export const runSchedulerLocally = async (jobs, algo) => {
+  const engine = await loadEngine(algo);
+  if (!engine) return null;
+
+  const n = jobs.length;
+  const withPriority = algo === "priority";
+  const columns = withPriority ? 7 : 6;
+  const inputs = [
+    Int32Array.from(jobs, (j) => j.arrivalTime),
+    Int32Array.from(jobs, (j) => j.burstTime),
+  ];
+  if (withPriority) inputs.push(Int32Array.from(jobs, (j) => j.priority));
+
+  const { count, out } = withBuffers(engine, inputs, n * columns, (ptrs, outPtr) =>
+    engine._schedule(...ptrs, n, outPtr)
+  );
+
+  const processes = [];
+  for (let i = 0; i < count; i++) {
+    const row = out.subarray(i * columns, (i + 1) * columns);
+    const [id, arrivalTime, burstTime] = row;
+    const [completionTime, turnaroundTime, waitingTime] = row.subarray(columns - 3);
+    processes.push(withPriority
+      ? { id, arrivalTime, burstTime, priority: row[3], completionTime, turnaroundTime, waitingTime }
+      : { id, arrivalTime, burstTime, completionTime, turnaroundTime, waitingTime });
+  }
+
+  return {
+    jobs: processes,
+    avgTurnaroundTime: processes.reduce((sum, p) => sum + p.turnaroundTime, 0) / processes.length,
+    avgWaitingTime: processes.reduce((sum, p) => sum + p.waitingTime, 0) / processes.length,
+    throughput: processes.length / processes.reduce((max, p) => Math.max(max, p.completionTime), 0),
+  };
+};
+
+export const runPageReplacementLocally = async (pages, ramSlots, algo) => {
+  const engine = await loadEngine(algo);
+  if (!engine) return null;
+
+  const { out } = withBuffers(engine, [Int32Array.from(pages)], 2, (ptrs, outPtr) =>
+    engine._replacePages(ramSlots, ptrs[0], pages.length, outPtr)
+  );
+
+  return {
+    pageHits: out[0],
+    pageFaults: out[1],
+  };
+};